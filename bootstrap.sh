@@ -16,6 +16,8 @@
 # Usage:
 #   ./bootstrap.sh            build the current compiler at build/bin/saplangc2
 #   ./bootstrap.sh verify     also prove it self-hosts to a byte-identical fixpoint
+#   ./bootstrap.sh pgo        also build a profile-guided compiler trained on a self-compile,
+#                             and time it against a plain Release build
 set -e
 
 ROOT=$(cd "$(dirname "$0")" && pwd)
@@ -71,3 +73,31 @@ if [ "$1" = "verify" ]; then
         exit 1
     fi
 fi
+
+if [ "$1" = "pgo" ]; then
+    PROFDATA=${LLVM_PROFDATA:-llvm-profdata}
+    PGO=build/pgo
+    rm -rf "$PGO"; mkdir -p "$PGO"
+    echo "Building the instrumented compiler..."
+    "$OUT" stage2/saplangc.sl -o build/bin/saplangc2-instrumented -i "$INCLUDES" -l "LLVM-19" -target linux -config ProfileGenerate
+    echo "Training on a self-compile..."
+    LLVM_PROFILE_FILE="$PGO/%p.profraw" build/bin/saplangc2-instrumented stage2/saplangc.sl -o "$PGO/trained" -i "$INCLUDES" -l "LLVM-19" -target linux -config Release
+    "$PROFDATA" merge -o "$PGO/saplangc2.profdata" "$PGO"/*.profraw
+    echo "Building the Release and profile-guided compilers..."
+    "$OUT" stage2/saplangc.sl -o build/bin/saplangc2-release -i "$INCLUDES" -l "LLVM-19" -target linux -config Release
+    "$OUT" stage2/saplangc.sl -o build/bin/saplangc2-pgo -i "$INCLUDES" -l "LLVM-19" -target linux -config "ProfileUse=$PGO/saplangc2.profdata"
+    # Best of three self-compiles each, so a cold page cache does not decide the comparison.
+    best_ms() {
+        best=""
+        for run in 1 2 3; do
+            start=$(date +%s%N)
+            "$1" stage2/saplangc.sl -o "$PGO/timed" -i "$INCLUDES" -l "LLVM-19" -target linux > /dev/null 2>&1
+            ms=$(( ($(date +%s%N) - start) / 1000000 ))
+            if [ -z "$best" ] || [ "$ms" -lt "$best" ]; then best=$ms; fi
+        done
+        echo "$best"
+    }
+    release_ms=$(best_ms build/bin/saplangc2-release)
+    pgo_ms=$(best_ms build/bin/saplangc2-pgo)
+    echo "self-compile: Release ${release_ms} ms, ProfileUse ${pgo_ms} ms"
+fi
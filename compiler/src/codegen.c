@@ -83,7 +83,7 @@ void codegen_deinit(CodegenLLVM *cg) {
 	LLVMContextDispose(cg->llvm_context);
 }
 
-LLVMTypeRef map_to_llvm(CodegenLLVM *cg, Type *type, Symbol *table) {
+LLVMTypeRef map_to_llvm(CodegenLLVM *cg, Type *type, SymbolTable *table) {
 	assert(type);
 	switch (type->type_kind) {
 	case TYPE_PRIMITIVE:
@@ -177,7 +177,7 @@ LLVMTypeRef map_to_llvm(CodegenLLVM *cg, Type *type, Symbol *table) {
 #define DW_TAG_union_type 0x17
 #define DW_TAG_enumeration_type 0x04
 
-LLVMMetadataRef map_to_ditype(CodegenLLVM *cg, Type *type, Symbol *table) {
+LLVMMetadataRef map_to_ditype(CodegenLLVM *cg, Type *type, SymbolTable *table) {
 	assert(cg->should_build_debug);
 	if (!type)
 		return NULL;
@@ -422,9 +422,9 @@ typedef struct {
 	LLVMMetadataRef di_scope;
 } PassContext;
 
-LLVMValueRef codegen_ast(CodegenLLVM *cg, ASTNode *node, Symbol *stable, PassContext ctx);
+LLVMValueRef codegen_ast(CodegenLLVM *cg, ASTNode *node, SymbolTable *stable, PassContext ctx);
 
-static LLVMValueRef codegen_cond_to_bool(CodegenLLVM *cg, ASTNode *cond, Symbol *table, PassContext ctx) {
+static LLVMValueRef codegen_cond_to_bool(CodegenLLVM *cg, ASTNode *cond, SymbolTable *table, PassContext ctx) {
 	Type *natural = get_type(table, cond, ctx.current_scope, "");
 	PassContext c = ctx;
 	c.intention = PI_LOAD_VAL;
@@ -448,7 +448,7 @@ static LLVMValueRef codegen_cond_to_bool(CodegenLLVM *cg, ASTNode *cond, Symbol
 // Build a fat-pointer { ptr, u64 } when an array or typed-null decays into a
 // slice target. The array path re-enters codegen with PI_LOAD_PTR because the
 // caller's by-value load gave us contents, not the address we want.
-static LLVMValueRef maybe_decay_to_slice(CodegenLLVM *cg, ASTNode *expr, LLVMValueRef computed_val, Type *expected, Symbol *table, PassContext ctx) {
+static LLVMValueRef maybe_decay_to_slice(CodegenLLVM *cg, ASTNode *expr, LLVMValueRef computed_val, Type *expected, SymbolTable *table, PassContext ctx) {
 	if (!expected || expected->type_kind != TYPE_SLICE)
 		return computed_val;
 
@@ -494,7 +494,7 @@ static LLVMValueRef maybe_decay_to_slice(CodegenLLVM *cg, ASTNode *expr, LLVMVal
 }
 
 // Decay a fixed array argument to its address when the callee expects a pointer.
-static LLVMValueRef maybe_decay_to_pointer(CodegenLLVM *cg, ASTNode *expr, LLVMValueRef computed_val, Type *expected, Symbol *table, PassContext ctx) {
+static LLVMValueRef maybe_decay_to_pointer(CodegenLLVM *cg, ASTNode *expr, LLVMValueRef computed_val, Type *expected, SymbolTable *table, PassContext ctx) {
 	if (!expected || expected->type_kind != TYPE_POINTER)
 		return computed_val;
 	Type *actual = get_type(table, expr, ctx.current_scope, "");
@@ -506,7 +506,7 @@ static LLVMValueRef maybe_decay_to_pointer(CodegenLLVM *cg, ASTNode *expr, LLVMV
 	return codegen_ast(cg, expr, table, ptr_ctx);
 }
 
-LLVMValueRef codegen_assignment(CodegenLLVM *cg, ASTNode *node, Symbol *table, PassContext ctx) {
+LLVMValueRef codegen_assignment(CodegenLLVM *cg, ASTNode *node, SymbolTable *table, PassContext ctx) {
 	ASTNode *lvalue = node->data.assignment.lvalue;
 	assert(lvalue->type == AST_EXPR_IDENT || lvalue->type == AST_MEMBER_ACCESS || lvalue->type == AST_ARRAY_ACCESS ||
 		   (lvalue->type == AST_UNARY_EXPR && lvalue->data.unary_op.op == '*'));
@@ -557,7 +557,7 @@ LLVMValueRef codegen_assignment(CodegenLLVM *cg, ASTNode *node, Symbol *table, P
 	return LLVMBuildStore(cg->builder, rhs, lhs);
 }
 
-LLVMTypeRef codegen_struct_decl(CodegenLLVM *cg, ASTNode *node, Symbol *table) {
+LLVMTypeRef codegen_struct_decl(CodegenLLVM *cg, ASTNode *node, SymbolTable *table) {
 	assert(node->data.struct_decl.field_count < 257 && "can only have 256 fields max.");
 	LLVMTypeRef struct_type = LLVMGetTypeByName2(cg->llvm_context, node->data.struct_decl.resolved_name);
 	// Idempotent: the body-fill pre-pass and the main pass both reach this.
@@ -581,7 +581,7 @@ LLVMTypeRef codegen_struct_decl(CodegenLLVM *cg, ASTNode *node, Symbol *table) {
 	return struct_type;
 }
 
-LLVMTypeRef codegen_union_decl(CodegenLLVM *cg, ASTNode *node, Symbol *table) {
+LLVMTypeRef codegen_union_decl(CodegenLLVM *cg, ASTNode *node, SymbolTable *table) {
 	char union_name[512] = "";
 	sprintf(union_name, "union.%s", node->data.union_decl.resolved_name);
 	LLVMTypeRef struct_type = LLVMGetTypeByName2(cg->llvm_context, union_name);
@@ -604,7 +604,7 @@ LLVMTypeRef codegen_union_decl(CodegenLLVM *cg, ASTNode *node, Symbol *table) {
 	return struct_type;
 }
 
-LLVMValueRef codegen_member_access(CodegenLLVM *cg, ASTNode *node, Symbol *table, PassContext ctx) {
+LLVMValueRef codegen_member_access(CodegenLLVM *cg, ASTNode *node, SymbolTable *table, PassContext ctx) {
 	PassIntention tmp_intention = ctx.intention;
 	Type *base_type = get_type(table, node->data.member_access.base, ctx.current_scope, "");
 	assert(base_type);
@@ -684,7 +684,7 @@ LLVMValueRef codegen_member_access(CodegenLLVM *cg, ASTNode *node, Symbol *table
 	return NULL;
 }
 
-LLVMValueRef codegen_return(CodegenLLVM *cg, ASTNode *node, Symbol *table, PassContext ctx) {
+LLVMValueRef codegen_return(CodegenLLVM *cg, ASTNode *node, SymbolTable *table, PassContext ctx) {
 	// NOTE: this is copy pasted from codegen_function
 	// TODO: cache this probably
 	char *func_name = ctx.current_function_node->data.func_decl.resolved_name;
@@ -707,7 +707,7 @@ LLVMValueRef codegen_return(CodegenLLVM *cg, ASTNode *node, Symbol *table, PassC
 }
 
 // This can only be assignment
-LLVMValueRef codegen_literal(CodegenLLVM *cg, ASTNode *node, Symbol *table, PassContext ctx) {
+LLVMValueRef codegen_literal(CodegenLLVM *cg, ASTNode *node, SymbolTable *table, PassContext ctx) {
 	LLVMTypeRef ty = map_to_llvm(cg, ctx.expected_type, table);
 	switch (node->type) {
 	case AST_EXPR_LITERAL:
@@ -922,7 +922,7 @@ LLVMValueRef codegen_literal(CodegenLLVM *cg, ASTNode *node, Symbol *table, Pass
 	return NULL;
 }
 
-LLVMValueRef codegen_global_var_decl(CodegenLLVM *cg, ASTNode *node, Symbol *table, int is_extern) {
+LLVMValueRef codegen_global_var_decl(CodegenLLVM *cg, ASTNode *node, SymbolTable *table, int is_extern) {
 	LLVMTypeRef ty = map_to_llvm(cg, node->data.var_decl.type, table);
 	if (node->data.var_decl.type->type_kind == TYPE_FUNCTION)
 		ty = LLVMPointerType(ty, 0);
@@ -946,7 +946,7 @@ LLVMValueRef codegen_global_var_decl(CodegenLLVM *cg, ASTNode *node, Symbol *tab
 	return global_var;
 }
 
-LLVMValueRef codegen_var_decl(CodegenLLVM *cg, ASTNode *node, Symbol *table, PassContext ctx) {
+LLVMValueRef codegen_var_decl(CodegenLLVM *cg, ASTNode *node, SymbolTable *table, PassContext ctx) {
 	Symbol *sym = lookup_symbol(table, node->data.var_decl.resolved_name, ctx.current_scope);
 	assert(sym);
 	LLVMTypeRef ty = map_to_llvm(cg, node->data.var_decl.type, table);
@@ -984,7 +984,7 @@ LLVMValueRef codegen_var_decl(CodegenLLVM *cg, ASTNode *node, Symbol *table, Pas
 
 void free_str(void *str) { free(str); }
 
-LLVMValueRef codegen_function(CodegenLLVM *cg, ASTNode *node, Symbol *table) {
+LLVMValueRef codegen_function(CodegenLLVM *cg, ASTNode *node, SymbolTable *table) {
 	char *func_name = node->data.func_decl.resolved_name;
 	size_t func_name_len = strlen(func_name);
 	char *linkage_name = func_name;
@@ -1054,7 +1054,7 @@ LLVMValueRef codegen_function(CodegenLLVM *cg, ASTNode *node, Symbol *table) {
 	return fn;
 }
 
-LLVMValueRef codegen_unary(CodegenLLVM *cg, ASTNode *node, Symbol *table, PassContext ctx) {
+LLVMValueRef codegen_unary(CodegenLLVM *cg, ASTNode *node, SymbolTable *table, PassContext ctx) {
 	switch (node->data.unary_op.op) {
 	case '*': {
 		Type *type = get_type(table, node->data.unary_op.operand, ctx.current_scope, "");
@@ -1096,7 +1096,7 @@ LLVMValueRef codegen_unary(CodegenLLVM *cg, ASTNode *node, Symbol *table, PassCo
 	}
 }
 
-LLVMValueRef codegen_binary(CodegenLLVM *cg, ASTNode *node, Symbol *table, PassContext ctx) {
+LLVMValueRef codegen_binary(CodegenLLVM *cg, ASTNode *node, SymbolTable *table, PassContext ctx) {
 	TokenKind op = node->data.binary_op.op;
 	if (op == TOK_AND || op == TOK_OR) {
 		LLVMValueRef fn = LLVMGetNamedFunction(cg->module, ctx.current_function_node->data.func_decl.resolved_name);
@@ -1248,7 +1248,7 @@ LLVMValueRef codegen_binary(CodegenLLVM *cg, ASTNode *node, Symbol *table, PassC
 	}
 }
 
-void codegen_imported_symbol(CodegenLLVM *cg, Symbol *sym, Symbol *table) {
+void codegen_imported_symbol(CodegenLLVM *cg, Symbol *sym, SymbolTable *table) {
 	ASTNode *node = sym->node;
 	switch (node->type) {
 	case AST_VAR_DECL: {
@@ -1282,7 +1282,7 @@ void codegen_imported_symbol(CodegenLLVM *cg, Symbol *sym, Symbol *table) {
 	}
 }
 
-LLVMValueRef codegen_ast(CodegenLLVM *cg, ASTNode *node, Symbol *table, PassContext ctx) {
+LLVMValueRef codegen_ast(CodegenLLVM *cg, ASTNode *node, SymbolTable *table, PassContext ctx) {
 	if (cg->should_build_debug && ctx.di_scope && node->location.line > 0) {
 		LLVMMetadataRef loc = LLVMDIBuilderCreateDebugLocation(cg->llvm_context, node->location.line, node->location.col, ctx.di_scope, NULL);
 		LLVMSetCurrentDebugLocation2(cg->builder, loc);
@@ -1794,7 +1794,7 @@ LLVMValueRef codegen_ast(CodegenLLVM *cg, ASTNode *node, Symbol *table, PassCont
 	return NULL;
 }
 
-static void codegen_predeclare_fn(CodegenLLVM *cg, const char *resolved_name, Symbol *table, int set_extern) {
+static void codegen_predeclare_fn(CodegenLLVM *cg, const char *resolved_name, SymbolTable *table, int set_extern) {
 	Symbol *sym = lookup_symbol(table, resolved_name, 0);
 	if (!sym || !sym->type)
 		return;
@@ -1808,8 +1808,8 @@ static void codegen_predeclare_fn(CodegenLLVM *cg, const char *resolved_name, Sy
 		LLVMSetLinkage(llvm_fn, LLVMExternalLinkage);
 }
 
-void codegen_run(CodegenLLVM *cg, ASTNode *root, Symbol *table) {
-	for (Symbol *sym = table; sym; sym = sym->next) {
+void codegen_run(CodegenLLVM *cg, ASTNode *root, SymbolTable *table) {
+	for (Symbol *sym = symbol_table_head(table); sym; sym = sym->next) {
 		if (!sym->is_imported || !sym->node)
 			continue;
 		if (sym->node->type == AST_STRUCT_DECL) {
@@ -1823,7 +1823,7 @@ void codegen_run(CodegenLLVM *cg, ASTNode *root, Symbol *table) {
 				LLVMStructCreateNamed(cg->llvm_context, union_name);
 		}
 	}
-	for (Symbol *sym = table; sym; sym = sym->next) {
+	for (Symbol *sym = symbol_table_head(table); sym; sym = sym->next) {
 		if (sym->is_imported) {
 			codegen_imported_symbol(cg, sym, table);
 		}
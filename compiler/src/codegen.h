@@ -34,7 +34,7 @@ CodegenLLVM codegen_init(CodegenInitContext *init_params);
 
 void codegen_deinit(CodegenLLVM *cg);
 
-void codegen_run(CodegenLLVM *cg, ASTNode *root, Symbol *table);
+void codegen_run(CodegenLLVM *cg, ASTNode *root, SymbolTable *table);
 
 char *codegen_output_str(CodegenLLVM *cg);
 
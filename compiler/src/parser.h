@@ -260,8 +260,8 @@ typedef struct Parser {
 	char module_name[64];
 	int current_scope;
 	Scanner scanner;
-	Symbol *symbol_table;	// driver-owned despite first allocation here
-	Symbol *exported_table; // driver-owned despite first allocation here
+	SymbolTable *symbol_table;	 // driver-owned despite first allocation here
+	SymbolTable *exported_table; // driver-owned despite first allocation here
 	Token current_token;
 	// Silences parse_type reports during the statement parser's speculation.
 	int speculating;
@@ -273,8 +273,8 @@ typedef struct Parser {
 } Parser;
 
 typedef struct {
-	Symbol *symbol_table;	// not owned
-	Symbol *exported_table; // not owned
+	SymbolTable *symbol_table;	 // not owned
+	SymbolTable *exported_table; // not owned
 	ImportList imports;
 	ASTNode *ast;
 	bool has_errors;
@@ -286,11 +286,11 @@ typedef struct {
 
 // This is so I don't have to change the signature of parser_init in all tests
 typedef struct {
-	Symbol *internal_table;
-	Symbol *exported_table;
+	SymbolTable *internal_table;
+	SymbolTable *exported_table;
 } SymbolTableWrapper;
 
-Symbol *lookup_symbol(Symbol *table, const char *name, int current_scope);
+Symbol *lookup_symbol(SymbolTable *table, const char *name, int current_scope);
 
 // Parser takes ownership of the symbol tables
 CompilerResult parser_init(Parser *parser, Scanner scanner, SymbolTableWrapper *optional_table_wrapper);
@@ -299,7 +299,7 @@ CompilerResult parser_deinit(Parser *parser);
 
 void module_deinit(Module *module);
 
-CompilerResult symbol_table_print(Symbol *table, char *string);
+CompilerResult symbol_table_print(SymbolTable *table, char *string);
 
 CompilerResult parse_import_list(Parser *parser, ImportList *import_list);
 
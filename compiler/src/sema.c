@@ -7,11 +7,11 @@
 #include <stdio.h>
 #include <string.h>
 
-CompilerResult analyze_expr_literal(Symbol *table, Type *lvalue_type, ASTNode *node, int scope_level, const char *scope_specifier);
-CompilerResult analyze_switch_stmt(Symbol *table, ASTNode *node, int scope_level, const char *scope_specifier);
+CompilerResult analyze_expr_literal(SymbolTable *table, Type *lvalue_type, ASTNode *node, int scope_level, const char *scope_specifier);
+CompilerResult analyze_switch_stmt(SymbolTable *table, ASTNode *node, int scope_level, const char *scope_specifier);
 int literal_fits_type(ASTNode *node, Type *target);
 
-int is_known_type(Symbol *table, const Type *source, int current_scope) {
+int is_known_type(SymbolTable *table, const Type *source, int current_scope) {
 	if (!source)
 		return 0;
 	if (source->type_kind == TYPE_POINTER)
@@ -32,7 +32,7 @@ int is_known_type(Symbol *table, const Type *source, int current_scope) {
 	return 1;
 }
 
-Type *get_type(Symbol *table, ASTNode *node, int scope_level, const char *scope_specifier) {
+Type *get_type(SymbolTable *table, ASTNode *node, int scope_level, const char *scope_specifier) {
 	if (!node)
 		return NULL;
 	switch (node->type) {
@@ -224,12 +224,12 @@ Type *get_type(Symbol *table, ASTNode *node, int scope_level, const char *scope_
 	return NULL;
 }
 
-CompilerResult resolve_type(Symbol *table, Type *type, SourceLocation loc);
+CompilerResult resolve_type(SymbolTable *table, Type *type, SourceLocation loc);
 
 // Recurses through aggregate shapes (array/slice) and function signatures, but stops at
 // TYPE_POINTER — a pointer field never needs the pointee's layout, so opaque/non-visible
 // peers are fine there. Only TYPE_STRUCT/UNION/ENUM reached by value require visibility.
-static CompilerResult verify_type_visible(Symbol *table, Type *type, SourceLocation loc) {
+static CompilerResult verify_type_visible(SymbolTable *table, Type *type, SourceLocation loc) {
 	if (!type)
 		return RESULT_SUCCESS;
 	switch (type->type_kind) {
@@ -271,7 +271,7 @@ struct VisitedStruct {
 	struct VisitedStruct *next;
 };
 
-static CompilerResult verify_struct_fields_visible(Symbol *table, Type *struct_type, SourceLocation loc, struct VisitedStruct *visited) {
+static CompilerResult verify_struct_fields_visible(SymbolTable *table, Type *struct_type, SourceLocation loc, struct VisitedStruct *visited) {
 	if (!struct_type || (struct_type->type_kind != TYPE_STRUCT && struct_type->type_kind != TYPE_UNION))
 		return RESULT_SUCCESS;
 	for (struct VisitedStruct *v = visited; v; v = v->next) {
@@ -313,7 +313,7 @@ static CompilerResult verify_struct_fields_visible(Symbol *table, Type *struct_t
 	return RESULT_SUCCESS;
 }
 
-CompilerResult analyze_expr_ident(Symbol *table, ASTNode *node, int scope_level) {
+CompilerResult analyze_expr_ident(SymbolTable *table, ASTNode *node, int scope_level) {
 	// This should never be NULL at this point because we passed the analyze_ast call above
 	if (node->data.ident.resolved_name[0] != '\0') {
 		// We've either already done this or it's a global we don't want to touch
@@ -331,7 +331,7 @@ CompilerResult analyze_expr_ident(Symbol *table, ASTNode *node, int scope_level)
 	return RESULT_FAILURE;
 }
 
-CompilerResult analyze_unary_op(Symbol *table, ASTNode *node, int scope_level, const char *scope_specifier) {
+CompilerResult analyze_unary_op(SymbolTable *table, ASTNode *node, int scope_level, const char *scope_specifier) {
 	// First, analyze the sub-expression
 	CompilerResult res = analyze_ast(table, node->data.unary_op.operand, scope_level, scope_specifier);
 	if (res != RESULT_SUCCESS)
@@ -413,7 +413,7 @@ CompilerResult analyze_unary_op(Symbol *table, ASTNode *node, int scope_level, c
 // Analyze `{ptr, len}` against an implicit { T* ptr; u64 len; } slice header.
 // Returns 1 if the literal was consumed here, 0 if the caller should fall
 // through to the regular struct-literal path.
-static int try_analyze_slice_literal(Symbol *table, Type *expected_type, ASTNode *node, int scope_level, const char *scope_specifier, CompilerResult *out_result) {
+static int try_analyze_slice_literal(SymbolTable *table, Type *expected_type, ASTNode *node, int scope_level, const char *scope_specifier, CompilerResult *out_result) {
 	if (!expected_type || expected_type->type_kind != TYPE_SLICE)
 		return 0;
 	int init_count = node->data.struct_literal.count;
@@ -497,7 +497,7 @@ static int try_analyze_slice_literal(Symbol *table, Type *expected_type, ASTNode
 	return 1;
 }
 
-CompilerResult analyze_struct_literal(Symbol *table, Type *expected_type, ASTNode *node, int scope_level, const char *scope_specifier) {
+CompilerResult analyze_struct_literal(SymbolTable *table, Type *expected_type, ASTNode *node, int scope_level, const char *scope_specifier) {
 	assert(node->type == AST_STRUCT_LITERAL);
 	CompilerResult slice_result;
 	if (try_analyze_slice_literal(table, expected_type, node, scope_level, scope_specifier, &slice_result))
@@ -631,7 +631,7 @@ int string_lit_fits_target(ASTNode *node, Type *target) {
 	return elem && elem->type_kind == TYPE_PRIMITIVE && (elem->prim == PRIM_U8 || elem->prim == PRIM_I8);
 }
 
-CompilerResult analyze_expr_literal(Symbol *table, Type *lvalue_type, ASTNode *node, int scope_level, const char *scope_specifier) {
+CompilerResult analyze_expr_literal(SymbolTable *table, Type *lvalue_type, ASTNode *node, int scope_level, const char *scope_specifier) {
 	if (literal_fits_type(node, lvalue_type))
 		return RESULT_SUCCESS;
 
@@ -652,7 +652,7 @@ CompilerResult analyze_expr_literal(Symbol *table, Type *lvalue_type, ASTNode *n
 	return RESULT_FAILURE;
 }
 
-CompilerResult analyze_union_decl(Symbol *table, ASTNode *node, int scope_level, const char *scope_specifier) {
+CompilerResult analyze_union_decl(SymbolTable *table, ASTNode *node, int scope_level, const char *scope_specifier) {
 	assert(node && node->type == AST_UNION_DECL);
 	const char *union_name = node->data.union_decl.name;
 	ASTNode *field = node->data.union_decl.fields;
@@ -677,7 +677,7 @@ CompilerResult analyze_union_decl(Symbol *table, ASTNode *node, int scope_level,
 }
 
 // Extract the constant integer value of a switch case value AST node. Returns 1 on success.
-static int switch_case_value_const(Symbol *table, ASTNode *node, int scope_level, i64 *out_value) {
+static int switch_case_value_const(SymbolTable *table, ASTNode *node, int scope_level, i64 *out_value) {
 	if (!node)
 		return 0;
 	if (node->type == AST_CHAR_LIT) {
@@ -719,7 +719,7 @@ static int switch_case_value_const(Symbol *table, ASTNode *node, int scope_level
 	return 0;
 }
 
-CompilerResult analyze_switch_stmt(Symbol *table, ASTNode *node, int scope_level, const char *scope_specifier) {
+CompilerResult analyze_switch_stmt(SymbolTable *table, ASTNode *node, int scope_level, const char *scope_specifier) {
 	CompilerResult result = analyze_ast(table, node->data.switch_stmt.subject, scope_level, scope_specifier);
 	if (result != RESULT_SUCCESS)
 		return result;
@@ -818,7 +818,7 @@ CompilerResult analyze_switch_stmt(Symbol *table, ASTNode *node, int scope_level
 	return RESULT_SUCCESS;
 }
 
-CompilerResult analyze_ast(Symbol *table, ASTNode *node, int scope_level, const char *scope_specifier) {
+CompilerResult analyze_ast(SymbolTable *table, ASTNode *node, int scope_level, const char *scope_specifier) {
 	if (!node)
 		return RESULT_PASSED_NULL_PTR;
 	switch (node->type) {
@@ -963,11 +963,9 @@ CompilerResult analyze_ast(Symbol *table, ASTNode *node, int scope_level, const
 					ASTNode *ident = node->data.var_decl.init->data.unary_op.operand;
 					Type *target = node->data.var_decl.type;
 					Symbol *match = NULL;
-					for (Symbol *s = table; s != NULL; s = s->next) {
+					for (Symbol *s = symbol_table_named(table, ident->data.ident.name); s != NULL; s = s->next_same_name) {
 						if (s->kind != SYMB_FN)
 							continue;
-						if (strcmp(s->name, ident->data.ident.name) != 0)
-							continue;
 						if (!s->type || s->type->type_kind != TYPE_FUNCTION)
 							continue;
 						if (type_equals(s->type, target)) {
@@ -1361,8 +1359,8 @@ CompilerResult analyze_ast(Symbol *table, ASTNode *node, int scope_level, const
 				ns_prefix_len = strlen(ns_prefix);
 			}
 			int candidate_count = 0;
-			for (Symbol *s = table; s != NULL; s = s->next) {
-				if (s->kind != SYMB_FN || strcmp(s->name, callee->data.ident.name) != 0)
+			for (Symbol *s = symbol_table_named(table, callee->data.ident.name); s != NULL; s = s->next_same_name) {
+				if (s->kind != SYMB_FN)
 					continue;
 				if (ns_prefix_len && strncmp(s->resolved_name, ns_prefix, ns_prefix_len) != 0)
 					continue;
@@ -1370,8 +1368,8 @@ CompilerResult analyze_ast(Symbol *table, ASTNode *node, int scope_level, const
 			}
 				// One candidate in the module: pin it; the normal path below checks args (allowing implicit conversions the strict matcher rejects).
 			if (ns_prefix_len && candidate_count == 1) {
-				for (Symbol *s = table; s != NULL; s = s->next) {
-					if (s->kind == SYMB_FN && strcmp(s->name, callee->data.ident.name) == 0 && strncmp(s->resolved_name, ns_prefix, ns_prefix_len) == 0) {
+				for (Symbol *s = symbol_table_named(table, callee->data.ident.name); s != NULL; s = s->next_same_name) {
+					if (s->kind == SYMB_FN && strncmp(s->resolved_name, ns_prefix, ns_prefix_len) == 0) {
 						strncpy(callee->data.ident.resolved_name, s->resolved_name, sizeof(callee->data.ident.resolved_name));
 						break;
 					}
@@ -1380,11 +1378,9 @@ CompilerResult analyze_ast(Symbol *table, ASTNode *node, int scope_level, const
 			if (candidate_count > 1) {
 				Symbol *match = NULL;
 				int ambiguous = 0;
-				for (Symbol *s = table; s != NULL; s = s->next) {
+				for (Symbol *s = symbol_table_named(table, callee->data.ident.name); s != NULL; s = s->next_same_name) {
 					if (s->kind != SYMB_FN)
 						continue;
-					if (strcmp(s->name, callee->data.ident.name) != 0)
-						continue;
 					if (ns_prefix_len && strncmp(s->resolved_name, ns_prefix, ns_prefix_len) != 0)
 						continue;
 					int has_va = 0;
@@ -1986,7 +1982,7 @@ CompilerResult analyze_ast(Symbol *table, ASTNode *node, int scope_level, const
 	return RESULT_SUCCESS;
 }
 
-CompilerResult resolve_type(Symbol *table, Type *type, SourceLocation loc) {
+CompilerResult resolve_type(SymbolTable *table, Type *type, SourceLocation loc) {
 	if (type->type_kind == TYPE_UNDECIDED) {
 		Symbol *type_def = lookup_named_type(table, type, 0);
 		if (!type_def) {
@@ -2025,9 +2021,9 @@ CompilerResult resolve_type(Symbol *table, Type *type, SourceLocation loc) {
     return RESULT_SUCCESS;
 }
 
-CompilerResult resolve_types(Symbol *table, ASTNode *root, int should_traverse_symbols) {
+CompilerResult resolve_types(SymbolTable *table, ASTNode *root, int should_traverse_symbols) {
 	if (should_traverse_symbols) {
-		Symbol *sym = table;
+		Symbol *sym = symbol_table_head(table);
 		int result = 1;
 		while (sym) {
 			result &= resolve_type(table, sym->type, sym->node->location) == RESULT_SUCCESS;
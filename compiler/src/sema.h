@@ -4,7 +4,7 @@
 #include "util.h"
 
 // If given an AST_FUNC_DECL, will return return type of the function
-Type *get_type(Symbol *table, ASTNode *node, int scope_level, const char* scope_specifier);
+Type *get_type(SymbolTable *table, ASTNode *node, int scope_level, const char* scope_specifier);
 
 int literal_fits_type(ASTNode *node, Type *target);
 
@@ -17,6 +17,6 @@ int literal_fits_type(ASTNode *node, Type *target);
  * scope_level - minimum scope depth to look at
  * scope_specifier - optional parameter that is the function name if we're using this on nodes in body of a function, otherwise empty string (!!! not NULL)
  * */
-CompilerResult analyze_ast(Symbol *table, ASTNode *node, int scope_level, const char *scope_specifier);
+CompilerResult analyze_ast(SymbolTable *table, ASTNode *node, int scope_level, const char *scope_specifier);
 
-CompilerResult resolve_types(Symbol *table, ASTNode *root, int should_traverse_symtab);
+CompilerResult resolve_types(SymbolTable *table, ASTNode *root, int should_traverse_symtab);
@@ -5,13 +5,13 @@
 #include <stdlib.h>
 #include <string.h>
 
-CompilerResult symbol_table_print(Symbol *table, char *string) {
+CompilerResult symbol_table_print(SymbolTable *table, char *string) {
 	if (!table)
 		return RESULT_PASSED_NULL_PTR;
 
 	int max_name_len = 0;
 	int max_type_len = 0;
-	for (Symbol *sym = table; sym; sym = sym->next) {
+	for (Symbol *sym = table->head; sym; sym = sym->next) {
 		int name_len = strlen(sym->name);
 		max_name_len = name_len > max_name_len ? name_len : max_name_len;
 		int type_len = type_get_string_len(sym->type, 0);
@@ -33,7 +33,7 @@ CompilerResult symbol_table_print(Symbol *table, char *string) {
 
 	print(string, "\tScope\tSize\tAlignment\n");
 
-	for (Symbol *sym = table; sym; sym = sym->next) {
+	for (Symbol *sym = table->head; sym; sym = sym->next) {
 		if (sym->kind == SYMB_VAR) {
 			print(string, "Variable    \t%s", sym->name);
 		} else if (sym->kind == SYMB_STRUCT) {
@@ -63,31 +63,64 @@ CompilerResult symbol_table_print(Symbol *table, char *string) {
 	return RESULT_SUCCESS;
 }
 
-CompilerResult add_symbol(Symbol **table, ASTNode *node, const char *name, const char *resolved_name, int is_const, int is_extern, SymbolKind kind, Type *type, int scope_level) {
-	if (!table)
-		return RESULT_PASSED_NULL_PTR;
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+static SRWLOCK intern_lock = SRWLOCK_INIT;
+#define INTERN_LOCK() AcquireSRWLockExclusive(&intern_lock)
+#define INTERN_UNLOCK() ReleaseSRWLockExclusive(&intern_lock)
+#else
+#include <pthread.h>
+static pthread_mutex_t intern_lock = PTHREAD_MUTEX_INITIALIZER;
+#define INTERN_LOCK() pthread_mutex_lock(&intern_lock)
+#define INTERN_UNLOCK() pthread_mutex_unlock(&intern_lock)
+#endif
+
+// Modules parse on the thread pool, so the interner is shared and locked.
+static hashmap_t *interned_names = NULL;
+
+const char *intern_name(const char *name) {
+	INTERN_LOCK();
+	if (!interned_names)
+		interned_names = hashmap_create(1024, fnv1a_hash, string_equals);
+	char *found = hashmap_get(interned_names, name);
+	if (!found) {
+		found = strdup(name);
+		hashmap_put(interned_names, found, found);
+	}
+	INTERN_UNLOCK();
+	return found;
+}
 
-	Symbol *symb = malloc(sizeof(Symbol));
-	if (!symb)
-		return RESULT_MEMORY_ERROR;
+SymbolTable *symbol_table_create(void) {
+	SymbolTable *table = malloc(sizeof(SymbolTable));
+	if (!table)
+		return NULL;
+	table->head = NULL;
+	table->by_resolved_name = hashmap_create(64, fnv1a_hash, string_equals);
+	table->by_name = hashmap_create(64, fnv1a_hash, string_equals);
+	table->externs = NULL;
+	table->count = 0;
+	return table;
+}
 
-	strncpy(symb->name, name, sizeof(symb->name));
-	strncpy(symb->resolved_name, resolved_name, sizeof(symb->resolved_name));
-	symb->type = copy_type(type);
-	symb->kind = kind;
-	symb->scope_level = scope_level;
-	symb->is_const = is_const;
-	symb->is_extern = is_extern;
-	symb->size = 0;
-	symb->alignment = 0;
-	symb->node = node;
-	symb->is_imported = 0;
-	symb->next = *table;
-	*table = symb;
-	return RESULT_SUCCESS;
+// Links symb in front of everything, both in the full list and in its name chains.
+static void link_symbol(SymbolTable *table, Symbol *symb) {
+	symb->seq = table->count++;
+	symb->next = table->head;
+	table->head = symb;
+	symb->next_same_resolved = hashmap_get(table->by_resolved_name, symb->resolved_name);
+	hashmap_put(table->by_resolved_name, (void *)symb->resolved_name, symb);
+	symb->next_same_name = hashmap_get(table->by_name, symb->name);
+	hashmap_put(table->by_name, (void *)symb->name, symb);
+	symb->next_extern = NULL;
+	if (symb->is_extern) {
+		symb->next_extern = table->externs;
+		table->externs = symb;
+	}
 }
 
-CompilerResult add_symbol_with_type_info(Symbol **table, ASTNode *node, const char *name, const char *resolved_name, int is_const, int is_imported, int is_extern, SymbolKind kind, Type *type, int scope_level, size_t size, size_t align) {
+static CompilerResult add_symbol_with_type_info(SymbolTable *table, ASTNode *node, const char *name, const char *resolved_name, int is_const, int is_imported, int is_extern, SymbolKind kind, Type *type, int scope_level, size_t size, size_t align) {
 	if (!table)
 		return RESULT_PASSED_NULL_PTR;
 
@@ -95,8 +128,8 @@ CompilerResult add_symbol_with_type_info(Symbol **table, ASTNode *node, const ch
 	if (!symb)
 		return RESULT_MEMORY_ERROR;
 
-	strncpy(symb->name, name, sizeof(symb->name));
-	strncpy(symb->resolved_name, resolved_name, sizeof(symb->resolved_name));
+	symb->name = intern_name(name);
+	symb->resolved_name = intern_name(resolved_name);
 	symb->type = type;
 	symb->kind = kind;
 	symb->scope_level = scope_level;
@@ -106,97 +139,122 @@ CompilerResult add_symbol_with_type_info(Symbol **table, ASTNode *node, const ch
 	symb->size = size;
 	symb->alignment = align;
 	symb->node = node;
-	symb->next = *table;
-	*table = symb;
+	link_symbol(table, symb);
 	return RESULT_SUCCESS;
 }
 
-CompilerResult deinit_symbol_table(Symbol *table) {
+CompilerResult add_symbol(SymbolTable **table, ASTNode *node, const char *name, const char *resolved_name, int is_const, int is_extern, SymbolKind kind, Type *type, int scope_level) {
+	if (!table)
+		return RESULT_PASSED_NULL_PTR;
+	if (!*table)
+		*table = symbol_table_create();
+	if (!*table)
+		return RESULT_MEMORY_ERROR;
+	return add_symbol_with_type_info(*table, node, name, resolved_name, is_const, 0, is_extern, kind, copy_type(type), scope_level, 0, 0);
+}
+
+CompilerResult deinit_symbol_table(SymbolTable *table) {
+	if (!table)
+		return RESULT_PASSED_NULL_PTR;
 	// Symbols are heap-allocated, but their Type pointers live in the
 	// owning module's type_arena and get dropped in bulk by
-	// module_deinit. We only free the Symbol cells here.
-	for (Symbol *sym = table; sym != NULL;) {
+	// module_deinit. Names belong to the interner. We only free the
+	// Symbol cells and the indexes here.
+	for (Symbol *sym = table->head; sym != NULL;) {
 		Symbol *next = sym->next;
 		free(sym);
 		sym = next;
 	}
+	hashmap_destroy(table->by_resolved_name, NULL, NULL);
+	hashmap_destroy(table->by_name, NULL, NULL);
+	free(table);
 	return RESULT_SUCCESS;
 }
 
-Symbol *lookup_symbol(Symbol *table, const char *resolved_name, int current_scope) {
-	for (Symbol *s = table; s != NULL; s = s->next) {
-		if (strcmp(s->resolved_name, resolved_name) == 0 && s->scope_level <= current_scope)
+Symbol *symbol_table_head(SymbolTable *table) { return table ? table->head : NULL; }
+
+Symbol *symbol_table_named(SymbolTable *table, const char *name) { return table ? hashmap_get(table->by_name, name) : NULL; }
+
+Symbol *lookup_symbol(SymbolTable *table, const char *resolved_name, int current_scope) {
+	if (!table)
+		return NULL;
+	for (Symbol *s = hashmap_get(table->by_resolved_name, resolved_name); s != NULL; s = s->next_same_resolved) {
+		if (s->scope_level <= current_scope)
 			return s;
 	}
 	return NULL;
 }
 
-Symbol *lookup_named_type(Symbol *table, const Type *type, int current_scope) {
-	for (Symbol *s = table; s != NULL; s = s->next) {
-		if (strcmp(s->resolved_name, type->type_resolved_name) == 0 && s->scope_level <= current_scope)
-			return s;
-		char resolved_name[256] = "";
-		if (type->type_namespace[0] != '\0') {
-			sprintf(resolved_name, "__%s_%s", type->type_namespace, type->type_name);
-		} else {
-			strncpy(resolved_name, type->type_name, sizeof(resolved_name));
+// The table used to be a bare list walked front to back, so of several matches the one nearest the
+// head wins; seq tells which that is across the separate chains.
+static Symbol *nearer_head(Symbol *a, Symbol *b) {
+	if (!a)
+		return b;
+	if (!b)
+		return a;
+	return a->seq > b->seq ? a : b;
+}
+
+Symbol *lookup_named_type(SymbolTable *table, const Type *type, int current_scope) {
+	if (!table)
+		return NULL;
+	Symbol *found = lookup_symbol(table, type->type_resolved_name, current_scope);
+	char resolved_name[256] = "";
+	if (type->type_namespace[0] != '\0') {
+		sprintf(resolved_name, "__%s_%s", type->type_namespace, type->type_name);
+	} else {
+		strncpy(resolved_name, type->type_name, sizeof(resolved_name));
+	}
+	found = nearer_head(found, lookup_symbol(table, resolved_name, current_scope));
+	// Extern types are matched on the type they declare, which sema may still be filling in, so
+	// they are not indexed; there are few of them.
+	for (Symbol *s = table->externs; s != NULL; s = s->next_extern) {
+		if (found && found->seq > s->seq)
+			break;
+		if (s->type && strcmp(s->type->type_namespace, type->type_namespace) == 0 && strcmp(s->type->type_name, type->type_name) == 0) {
+			found = s;
+			break;
 		}
-		if (strcmp(s->resolved_name, resolved_name) == 0 && s->scope_level <= current_scope)
-			return s;
-		if (s->is_extern && strcmp(s->type->type_namespace, type->type_namespace) == 0 && strcmp(s->type->type_name, type->type_name) == 0)
-			return s;
 	}
-	return NULL;
+	return found;
 }
 
-Symbol *lookup_symbol_weak(Symbol *table, const char *name, int current_scope) {
-	for (Symbol *s = table; s != NULL; s = s->next) {
-		if (strcmp(s->name, name) == 0 && s->scope_level <= current_scope)
+Symbol *lookup_symbol_weak(SymbolTable *table, const char *name, int current_scope) {
+	for (Symbol *s = symbol_table_named(table, name); s != NULL; s = s->next_same_name) {
+		if (s->scope_level <= current_scope)
 			return s;
 	}
 	return NULL;
 }
 
-Symbol *symbol_table_copy(Symbol *table) {
-	Symbol *new_table = malloc(sizeof(Symbol));
-
-	new_table->type = copy_type(table->type);
-	new_table->node = table->node;
-	new_table->is_const = table->is_const;
-	new_table->kind = table->kind;
-	new_table->alignment = table->alignment;
-	new_table->size = table->size;
-	new_table->scope_level = table->scope_level;
-	new_table->is_extern = table->is_extern;
-	new_table->next = NULL;
-	strncpy(new_table->name, table->name, sizeof(new_table->name));
-	strncpy(new_table->resolved_name, table->resolved_name, sizeof(new_table->resolved_name));
-
-	Symbol *current = table->next;
-	while (current) {
-		Type *type_copy = copy_type(current->type);
-		ASTNode *node = current->node;
-		add_symbol_with_type_info(&new_table, node, current->name, current->resolved_name, current->is_const, current->is_imported, current->is_extern, current->kind, type_copy, current->scope_level, current->size, current->alignment);
-		current = current->next;
+SymbolTable *symbol_table_copy(SymbolTable *table) {
+	SymbolTable *new_table = symbol_table_create();
+	if (!table || !new_table)
+		return new_table;
+	// Linking prepends, so copy from the tail to keep the order.
+	Symbol **order = malloc(table->count * sizeof(Symbol *));
+	size_t n = 0;
+	for (Symbol *current = table->head; current; current = current->next)
+		order[n++] = current;
+	while (n > 0) {
+		Symbol *current = order[--n];
+		add_symbol_with_type_info(new_table, current->node, current->name, current->resolved_name, current->is_const, current->is_imported, current->is_extern, current->kind, copy_type(current->type), current->scope_level, current->size, current->alignment);
 	}
-
+	free(order);
 	return new_table;
 }
 
-Symbol *symbol_table_merge(Symbol *external, Symbol *internal) {
+SymbolTable *symbol_table_merge(SymbolTable *external, SymbolTable *internal) {
+	if (!internal)
+		internal = symbol_table_create();
 	if (!external)
 		return internal;
-
-	Symbol *new_root = symbol_table_copy(external);
-	for (Symbol *sym = new_root; sym; sym = sym->next) {
-		sym->is_imported = 1;
-	}
-	Symbol *current_ext = new_root;
-	while (current_ext->next) {
-		current_ext = current_ext->next;
+	// Front to back, each copy in front of the last: the imported symbols end up ahead of the
+	// module's own in reverse export order, as they always have.
+	for (Symbol *current = external->head; current; current = current->next) {
+		add_symbol_with_type_info(internal, current->node, current->name, current->resolved_name, current->is_const, 1, current->is_extern, current->kind, copy_type(current->type), current->scope_level, current->size, current->alignment);
 	}
-	current_ext->next = internal;
-	return new_root;
+	return internal;
 }
 
 void set_size(Symbol *symbol) {
@@ -212,8 +270,8 @@ void set_size(Symbol *symbol) {
 	symbol->alignment = info.align;
 }
 
-void symbol_table_set_type_info(Symbol *table) {
-	Symbol *current = table;
+void symbol_table_set_type_info(SymbolTable *table) {
+	Symbol *current = symbol_table_head(table);
 	while (current) {
 		set_size(current);
 		current = current->next;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "hashmap.h"
 #include "types.h"
 #include "util.h"
 
@@ -12,8 +13,8 @@ typedef enum {
 } SymbolKind;
 
 typedef struct Symbol {
-	char name[64];
-	char resolved_name[512];
+	const char *name;		   // interned; see intern_name
+	const char *resolved_name; // interned
 	Type *type;
 	int scope_level;
 	SymbolKind kind;
@@ -23,23 +24,55 @@ typedef struct Symbol {
 	struct ASTNode *node; // not owning
 	size_t size;
 	size_t alignment;
-	struct Symbol *next;
+	size_t seq;						   // insertion order within the table; higher = nearer the head
+	struct Symbol *next;			   // every symbol, most recent first
+	struct Symbol *next_same_resolved; // same resolved_name, most recent first
+	struct Symbol *next_same_name;	   // same name, most recent first
+	struct Symbol *next_extern;		   // extern symbols only, most recent first
 } Symbol;
 
-CompilerResult symbol_table_print(Symbol *table, char *string);
+// Symbols hang off one list in the order they were added (newest first), which is the order every
+// lookup has always resolved ties in. Each name additionally keys a chain of just the symbols
+// carrying it, so a lookup walks the handful of same-named candidates instead of the whole table.
+typedef struct SymbolTable {
+	Symbol *head;
+	hashmap_t *by_resolved_name; // interned resolved_name -> newest Symbol with it
+	hashmap_t *by_name;			 // interned name -> newest Symbol with it
+	Symbol *externs;
+	size_t count;
+} SymbolTable;
 
-CompilerResult add_symbol(Symbol **table, struct ASTNode *node, const char *name, const char *resolved_name, int is_const, int is_extern, SymbolKind kind, Type *type, int scope_level);
+// Returns the canonical copy of name; equal strings intern to the same pointer. Interned names
+// live for the rest of the process. Thread-safe.
+const char *intern_name(const char *name);
 
-CompilerResult deinit_symbol_table(Symbol *table);
+SymbolTable *symbol_table_create(void);
 
-Symbol *lookup_symbol(Symbol *table, const char *name, int current_scope);
+CompilerResult symbol_table_print(SymbolTable *table, char *string);
 
-Symbol *lookup_named_type(Symbol *table, const Type *type, int current_scope);
+// Creates *table on first use.
+CompilerResult add_symbol(SymbolTable **table, struct ASTNode *node, const char *name, const char *resolved_name, int is_const, int is_extern, SymbolKind kind, Type *type, int scope_level);
 
-Symbol *lookup_symbol_weak(Symbol *table, const char *name, int current_scope);
+CompilerResult deinit_symbol_table(SymbolTable *table);
 
-Symbol *symbol_table_copy(Symbol *table);
+// Most recent symbol with this resolved name declared at or below current_scope.
+Symbol *lookup_symbol(SymbolTable *table, const char *name, int current_scope);
 
-void symbol_table_set_type_info(Symbol *table);
+Symbol *lookup_named_type(SymbolTable *table, const Type *type, int current_scope);
 
-Symbol *symbol_table_merge(Symbol *external, Symbol *internal);
+// As lookup_symbol, but by the unmangled name.
+Symbol *lookup_symbol_weak(SymbolTable *table, const char *name, int current_scope);
+
+// Iteration: for (Symbol *s = symbol_table_head(table); s; s = s->next). NULL tables are empty.
+Symbol *symbol_table_head(SymbolTable *table);
+
+// Every symbol with this unmangled name, regardless of scope: walk ->next_same_name.
+Symbol *symbol_table_named(SymbolTable *table, const char *name);
+
+SymbolTable *symbol_table_copy(SymbolTable *table);
+
+void symbol_table_set_type_info(SymbolTable *table);
+
+// Prepends copies of external's symbols, marked imported, to internal (created if NULL) and
+// returns it.
+SymbolTable *symbol_table_merge(SymbolTable *external, SymbolTable *internal);
@@ -8,13 +8,13 @@
 #include <string.h>
 
 static __thread Arena *current_type_arena = NULL;
-static __thread Symbol *current_type_table = NULL;
+static __thread SymbolTable *current_type_table = NULL;
 
 void type_arena_set(Arena *arena) { current_type_arena = arena; }
 
 Arena *type_arena_get(void) { return current_type_arena; }
 
-void type_table_set(Symbol *table) { current_type_table = table; }
+void type_table_set(SymbolTable *table) { current_type_table = table; }
 
 PrimitiveKind primitive_kind_from_name(const char *name) {
 	if (!name)
@@ -693,7 +693,7 @@ int is_widening_float_conversion(const Type *src, const Type *tgt) {
 	return src_w > 0 && tgt_w > 0 && src_w <= tgt_w;
 }
 
-int is_convertible(const Type *source, const Type *target, int permissive, Symbol *table) {
+int is_convertible(const Type *source, const Type *target, int permissive, SymbolTable *table) {
 	if (!source || !target)
 		return 0;
 
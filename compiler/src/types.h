@@ -3,7 +3,7 @@
 #include "arena.h"
 #include <stddef.h>
 
-struct Symbol;
+struct SymbolTable;
 
 typedef struct {
 	size_t size;
@@ -61,7 +61,7 @@ typedef struct Type {
 // Set by parser/sema/codegen tasks before any Type constructor call.
 void type_arena_set(Arena *arena);
 Arena *type_arena_get(void);
-void type_table_set(struct Symbol *table);
+void type_table_set(struct SymbolTable *table);
 
 Type *copy_type(Type *type);
 // No-op — Types live in the module arena, freed in bulk by module_deinit.
@@ -108,6 +108,6 @@ int is_builtin(const Type *type);
 int is_int(const Type *type);
 int is_float(const Type *type);
 
-struct Symbol;
+struct SymbolTable;
 
-int is_convertible(const Type *source, const Type *target, int permissive, struct Symbol *table);
+int is_convertible(const Type *source, const Type *target, int permissive, struct SymbolTable *table);
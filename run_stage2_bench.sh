@@ -0,0 +1,31 @@
+#!/bin/sh
+# Compile-time benchmarks of the stage-2 compiler (stage2/bench/selfhost_bench.sl and
+# stage2/bench/scale_bench.sl).
+#
+# Usage:
+#   ./run_stage2_bench.sh                       measure and write build/bench/selfhost.json
+#   ./run_stage2_bench.sh -baseline <file>      also fail on a regression against an earlier run
+#   ./run_stage2_bench.sh scale                 phase growth against input size; writes build/bench/scale.csv
+#   Further arguments go to selfhost_bench (-runs, -corpus-fns, -threshold, ...) or, after
+#   `scale`, to scale_bench (-steps, -runs, -only, ...).
+set -eu
+
+ROOT="$(cd "$(dirname "$0")" && pwd)"
+cd "$ROOT"
+
+SAPLANGC2=build/bin/saplangc2
+OUT_DIR=build/bench
+
+if [ ! -x "$SAPLANGC2" ]; then
+	echo "error: $SAPLANGC2 not found; run ./bootstrap.sh first" >&2
+	exit 1
+fi
+
+mkdir -p "$OUT_DIR"
+if [ "${1:-}" = scale ]; then
+	shift
+	"$SAPLANGC2" stage2/bench/scale_bench.sl -o "$OUT_DIR/scale_bench" -i "stage2/std;stage2;stage2/bench" -target linux -config Release
+	exec "$OUT_DIR/scale_bench" -compiler "$SAPLANGC2" -work-dir "$OUT_DIR/work" -csv "$OUT_DIR/scale.csv" "$@"
+fi
+"$SAPLANGC2" stage2/bench/selfhost_bench.sl -o "$OUT_DIR/selfhost_bench" -i "stage2/std;stage2;stage2/bench" -target linux -config Release
+"$OUT_DIR/selfhost_bench" -compiler "$SAPLANGC2" -work-dir "$OUT_DIR/work" -json "$OUT_DIR/selfhost.json" "$@"
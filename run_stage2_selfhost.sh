@@ -57,4 +57,17 @@ for f in stage2/tests/*.sl; do
 done
 echo "mt: $mtfail failed (x$MT_REPEATS each)"
 
-[ "$bfail" -eq 0 ] && [ "$rfail" -eq 0 ] && [ "$mtfail" -eq 0 ]
+# Third pass through -backend fast: every test binary built by x64.sl instead of LLVM.
+fastfail=0
+for f in stage2/tests/*.sl; do
+    base=$(basename "$f" .sl)
+    [ "$base" = "test_util" ] && continue
+    if "$SC" "$f" -o "$TMP/fast-$base" -i "$INC" -l "LLVM-19" -l "m" -target linux -backend fast > "$TMP/fast-$base.log" 2>&1; then
+        "$TMP/fast-$base" > /dev/null 2>&1 || { fastfail=$((fastfail + 1)); echo "  FAST-RUN-FAIL: $base"; }
+    else
+        fastfail=$((fastfail + 1)); echo "  FAST-BUILD-FAIL: $base :: $(first_error "$TMP/fast-$base.log")"
+    fi
+done
+echo "fast: $fastfail failed"
+
+[ "$bfail" -eq 0 ] && [ "$rfail" -eq 0 ] && [ "$mtfail" -eq 0 ] && [ "$fastfail" -eq 0 ]
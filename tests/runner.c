@@ -3,6 +3,7 @@
 #include "parser_tests.h"
 #include "scanner_tests.h"
 #include "sema_tests.h"
+#include "symbol_table_tests.h"
 #include "threadpool_tests.h"
 #include "typeinfo_tests.h"
 #include "module_tests.h"
@@ -42,6 +43,10 @@ int main(int argc, char **argv) {
 	RUN_TEST(test_hashmap_remove_missing_key);
 	RUN_TEST(test_hashmap_rehash);
 
+	RUN_TEST(test_symbol_table_interns_names);
+	RUN_TEST(test_symbol_table_scoped_lookup);
+	RUN_TEST(test_symbol_table_merge_order);
+
 	/* RUN_TEST(test_PrintfTest); */
 
 	RUN_TEST(test_VariableDeclaration);
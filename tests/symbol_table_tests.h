@@ -0,0 +1,64 @@
+#pragma once
+
+#include "unity.h"
+#include <arena.h>
+#include <symbol_table.h>
+#include <types.h>
+
+// Test: equal names intern to one pointer
+void test_symbol_table_interns_names(void) {
+	char buf[16];
+	strcpy(buf, "counter");
+	TEST_ASSERT_EQUAL_PTR(intern_name("counter"), intern_name(buf));
+	TEST_ASSERT_TRUE(intern_name("counter") != intern_name("counters"));
+}
+
+// Test: the newest declaration visible from the scope wins; deeper ones stay hidden
+void test_symbol_table_scoped_lookup(void) {
+	Arena arena;
+	arena_init(&arena, 0);
+	type_arena_set(&arena);
+
+	SymbolTable *table = NULL;
+	Type *i32_t = new_primitive_type("i32");
+	TEST_ASSERT_EQUAL_INT(RESULT_SUCCESS, add_symbol(&table, NULL, "x", "x", 0, 0, SYMB_VAR, i32_t, 0));
+	TEST_ASSERT_EQUAL_INT(RESULT_SUCCESS, add_symbol(&table, NULL, "x", "x", 1, 0, SYMB_VAR, i32_t, 2));
+	TEST_ASSERT_EQUAL_INT(1, lookup_symbol(table, "x", 2)->is_const);
+	TEST_ASSERT_EQUAL_INT(0, lookup_symbol(table, "x", 1)->is_const);
+	TEST_ASSERT_NULL(lookup_symbol(table, "y", 2));
+	TEST_ASSERT_NULL(lookup_symbol(NULL, "x", 2));
+	TEST_ASSERT_EQUAL_INT(0, lookup_symbol_weak(table, "x", 0)->is_const);
+
+	deinit_symbol_table(table);
+	type_arena_set(NULL);
+	arena_deinit(&arena);
+}
+
+// Test: merged symbols sit ahead of the module's own, marked imported, in the order merges always produced
+void test_symbol_table_merge_order(void) {
+	Arena arena;
+	arena_init(&arena, 0);
+	type_arena_set(&arena);
+
+	SymbolTable *exported = NULL;
+	SymbolTable *internal = NULL;
+	Type *i32_t = new_primitive_type("i32");
+	add_symbol(&exported, NULL, "a", "__lib_a", 1, 0, SYMB_FN, i32_t, 0);
+	add_symbol(&exported, NULL, "b", "__lib_b", 1, 0, SYMB_FN, i32_t, 0);
+	add_symbol(&internal, NULL, "main", "main", 1, 0, SYMB_FN, i32_t, 0);
+	internal = symbol_table_merge(exported, internal);
+
+	Symbol *s = symbol_table_head(internal);
+	TEST_ASSERT_EQUAL_STRING("__lib_a", s->resolved_name);
+	TEST_ASSERT_TRUE(s->is_imported);
+	TEST_ASSERT_EQUAL_STRING("__lib_b", s->next->resolved_name);
+	TEST_ASSERT_EQUAL_STRING("main", s->next->next->resolved_name);
+	TEST_ASSERT_FALSE(s->next->next->is_imported);
+	TEST_ASSERT_TRUE(lookup_symbol(internal, "__lib_b", 0)->is_imported);
+	TEST_ASSERT_EQUAL_PTR(s->next, symbol_table_named(internal, "b"));
+
+	deinit_symbol_table(exported);
+	deinit_symbol_table(internal);
+	type_arena_set(NULL);
+	arena_deinit(&arena);
+}